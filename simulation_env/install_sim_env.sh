@@ -122,6 +122,10 @@ cd .. && rm -rf verilator
 # Build RISC-V GNU Toolchain (two prefixes: rv32i_zicntr, rv64i_zicntr)
 #   - Pinned to tag 2025.01.20 (adjust if needed)
 #   - Newlib bare-metal toolchains with minimal ISA profiles used by SCHOLAR RISC-V
+#   - Extensions such as Zicond or Zca/Zcb/Zcmp need no dedicated prefix: the
+#     libraries are built for rv32i_zicntr/rv64i_zicntr and are linked unchanged
+#     into firmware built with an extended -march (e.g. -march=rv32i_zicntr_zicond
+#     or -march=rv32i_zicntr_zca_zcb_zcmp)
 # ================================================================================
 git clone https://github.com/riscv-collab/riscv-gnu-toolchain.git && \
 cd riscv-gnu-toolchain && \